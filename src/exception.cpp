@@ -40,4 +40,30 @@ namespace ftl {
 	: std::out_of_range(message)
 	{}
 
-}
+	// Vector size mismatch
+	vector_size_mismatch::vector_size_mismatch()
+	: std::length_error("vector size mismatch")
+	{}
+
+	vector_size_mismatch::vector_size_mismatch(const std::string& message)
+	: std::length_error(message)
+	{}
+
+	vector_size_mismatch::vector_size_mismatch(const char* message)
+	: std::length_error(message)
+	{}
+
+	// Full ring buffer
+	ring_buffer_full::ring_buffer_full()
+	: std::length_error("ring buffer full")
+	{}
+
+	ring_buffer_full::ring_buffer_full(const std::string& message)
+	: std::length_error(message)
+	{}
+
+	ring_buffer_full::ring_buffer_full(const char* message)
+	: std::length_error(message)
+	{}
+
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/deque>
+
+using namespace ftl;
+
+TEST(deque, construct_default)
+{
+    deque<int> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(x.begin(), x.end());
+}
+
+TEST(deque, construct_with_ilist)
+{
+    deque<int> x { 1, 2, 3, 4, 5 };
+    ASSERT_EQ(5u, x.size());
+    ASSERT_EQ(1, x.front());
+    ASSERT_EQ(5, x.back());
+    ASSERT_EQ(3, x[2]);
+    ASSERT_THROW(x.at(5), array_out_of_range);
+}
+
+TEST(deque, push_both_ends)
+{
+    deque<int> x;
+    const int n = 3 * static_cast<int>(deque<int>::block_size) + 7;
+    for (int i = 0; i < n; ++i) {
+        x.push_back(i);
+        x.push_front(-i - 1);
+    }
+    ASSERT_EQ(static_cast<size_t>(2 * n), x.size());
+    for (int i = 0; i < 2 * n; ++i) ASSERT_EQ(i - n, x[i]);
+
+    int expected = n - 1;
+    for (auto it = x.rbegin(); it != x.rend(); ++it) ASSERT_EQ(expected--, *it);
+    ASSERT_EQ(2 * n, x.end() - x.begin());
+    ASSERT_EQ(0, *(x.begin() + n));
+}
+
+TEST(deque, stable_references)
+{
+    deque<std::string> x;
+    x.push_back("first");
+    const std::string* first = &x[0];
+    for (int i = 0; i < 5000; ++i) {
+        x.emplace_back(std::to_string(i));
+        x.emplace_front(std::to_string(-i));
+    }
+    ASSERT_EQ(first, &x[5000]);
+    ASSERT_EQ("first", *first);
+}
+
+TEST(deque, fifo)
+{
+    deque<int> x;
+    for (int round = 0; round < 10000; ++round) {
+        x.push_back(round);
+        x.push_back(round);
+        x.pop_front();
+        ASSERT_EQ((round + 1) / 2, x.front());
+    }
+    ASSERT_EQ(10000u, x.size());
+    while (!x.empty()) x.pop_front();
+    x.push_front(1);
+    ASSERT_EQ(1, x.back());
+}
+
+TEST(deque, insert_and_erase)
+{
+    deque<int> x;
+    std::vector<int> ref;
+    unsigned seed = 3;
+    for (int step = 0; step < 3000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        const size_t pos = ref.empty() ? 0 : (seed >> 8) % (ref.size() + 1);
+        if ((seed >> 4) % 3 != 0 || ref.empty()) {
+            auto it = x.insert(x.begin() + pos, step);
+            ASSERT_EQ(step, *it);
+            ref.insert(ref.begin() + pos, step);
+        } else {
+            const size_t e = pos == ref.size() ? pos - 1 : pos;
+            x.erase(x.begin() + e);
+            ref.erase(ref.begin() + e);
+        }
+    }
+    ASSERT_EQ(ref.size(), x.size());
+    for (size_t i = 0; i < ref.size(); ++i) ASSERT_EQ(ref[i], x[i]);
+
+    x.erase(x.begin() + 10, x.begin() + 100);
+    ref.erase(ref.begin() + 10, ref.begin() + 100);
+    x.erase(x.end() - 50, x.end() - 20);
+    ref.erase(ref.end() - 50, ref.end() - 20);
+    ASSERT_EQ(ref.size(), x.size());
+    for (size_t i = 0; i < ref.size(); ++i) ASSERT_EQ(ref[i], x[i]);
+}
+
+TEST(deque, assign_and_resize)
+{
+    deque<std::string> x { "a", "b" };
+    x.assign(3, "c");
+    ASSERT_EQ((deque<std::string> { "c", "c", "c" }), x);
+    x = { "d", "e" };
+    ASSERT_EQ("e", x.back());
+    x.resize(4, "f");
+    ASSERT_EQ((deque<std::string> { "d", "e", "f", "f" }), x);
+    x.resize(1);
+    ASSERT_EQ(1u, x.size());
+    x.clear();
+    ASSERT_TRUE(x.empty());
+    x.shrink_to_fit();
+    x.push_back("g");
+    ASSERT_EQ("g", x.front());
+}
+
+TEST(deque, copy_and_move)
+{
+    deque<std::string> x { "a", "b", "c" };
+    x.push_front("z");
+    auto y = x;
+    ASSERT_EQ(x, y);
+    auto z = std::move(y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ(x, z);
+    z.push_back("d");
+    ASSERT_NE(x, z);
+    y = z;
+    swap(x, y);
+    ASSERT_EQ("d", x.back());
+    y.push_front("y");
+    ASSERT_EQ("y", y.front());
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <ftl/forward_list>
 #include <array>
+#include <functional>
+#include <string>
+#include <vector>
 #include <iostream>
 
 using namespace ftl;
@@ -218,3 +221,249 @@ TEST(forward_list, erase_after_4e)
 
     (void)x;
 }
+
+namespace {
+    struct counting_alloc_stats {
+        static inline int allocations = 0;
+    };
+
+    template <typename T>
+    struct counting_allocator : std::allocator<T> {
+        template <typename U>
+        struct rebind {
+            using other = counting_allocator<U>;
+        };
+
+        counting_allocator() = default;
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            ++counting_alloc_stats::allocations;
+            return std::allocator<T>::allocate(n);
+        }
+    };
+}
+
+TEST(forward_list, empty_does_not_allocate)
+{
+    counting_alloc_stats::allocations = 0;
+    {
+        forward_list<int, counting_allocator<fwd_list_node<int>>> a;
+        forward_list<int, counting_allocator<fwd_list_node<int>>> b(
+            std::move(a));
+        a = b;
+        ASSERT_TRUE(a.empty());
+        ASSERT_EQ(a.before_begin(), a.before_end());
+    }
+    ASSERT_EQ(0, counting_alloc_stats::allocations);
+}
+
+TEST(forward_list, push_back_size)
+{
+    forward_list<int> x;
+    ASSERT_EQ(0u, x.size());
+    x.push_back(1);
+    x.push_back(2);
+    x.emplace_back(3);
+    x.push_front(0);
+    ASSERT_EQ(4u, x.size());
+    ASSERT_EQ(0, x.front());
+    ASSERT_EQ(3, x.back());
+
+    int expected = 0;
+    for (const auto& v : x) ASSERT_EQ(expected++, v);
+}
+
+TEST(forward_list, tail_follows_erase)
+{
+    forward_list<int> x { 1, 2, 3 };
+    x.erase_after(x.begin() + 1);
+    ASSERT_EQ(2, x.back());
+    x.push_back(4);
+    ASSERT_EQ(4, x.back());
+    x.pop_front();
+    x.pop_front();
+    x.pop_front();
+    ASSERT_TRUE(x.empty());
+    x.push_back(5);
+    ASSERT_EQ(5, x.front());
+    ASSERT_EQ(5, x.back());
+    ASSERT_EQ(1u, x.size());
+}
+
+TEST(forward_list, insert_after_tail)
+{
+    forward_list<int> x { 1, 2 };
+    x.insert_after(x.before_end(), { 3, 4 });
+    ASSERT_EQ(4, x.back());
+    ASSERT_EQ(4u, x.size());
+    x.push_back(5);
+    auto cmp = { 1, 2, 3, 4, 5 };
+    auto it = x.begin();
+    for (const auto& v : cmp) {
+        ASSERT_EQ(v, *it);
+        ++it;
+    }
+}
+
+TEST(forward_list, splice_after_end)
+{
+    forward_list<int> x { 1, 2 };
+    forward_list<int> y { 3, 4 };
+    x.splice_after(x.before_end(), y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ(4u, x.size());
+    ASSERT_EQ(4, x.back());
+    x.push_back(5);
+    y.push_back(9);
+    ASSERT_EQ(9, y.front());
+
+    auto cmp = { 1, 2, 3, 4, 5 };
+    auto it = x.begin();
+    for (const auto& v : cmp) {
+        ASSERT_EQ(v, *it);
+        ++it;
+    }
+}
+
+TEST(forward_list, splice_after_range)
+{
+    forward_list<int> x { 1, 2 };
+    forward_list<int> y { 3, 4, 5, 6 };
+    // moves 4 and 5, leaving 6 in y
+    x.splice_after(x.before_begin(), y, y.begin(), y.begin() + 3);
+    ASSERT_EQ(4u, x.size());
+    ASSERT_EQ(2u, y.size());
+    ASSERT_EQ(2, x.back());
+
+    // moves the last node of y, whose tail falls back to 3
+    x.splice_after(x.before_end(), y, y.begin());
+    ASSERT_EQ(6, x.back());
+    ASSERT_EQ(3, y.back());
+    y.push_back(7);
+
+    auto cmp = { 4, 5, 1, 2, 6 };
+    auto it = x.begin();
+    for (const auto& v : cmp) {
+        ASSERT_EQ(v, *it);
+        ++it;
+    }
+    ASSERT_EQ(7, *(y.begin() + 1));
+}
+
+TEST(forward_list, swap_keeps_tails)
+{
+    forward_list<int> x { 1, 2, 3 };
+    forward_list<int> y;
+    x.swap(y);
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(3, y.back());
+    x.push_back(4);
+    y.push_back(5);
+    ASSERT_EQ(4, x.front());
+    ASSERT_EQ(4u, y.size());
+    ASSERT_EQ(5, y.back());
+}
+
+namespace {
+    template <typename T>
+    std::vector<T> to_vector(const forward_list<T>& l)
+    {
+        std::vector<T> v;
+        for (const auto& x : l) v.push_back(x);
+        return v;
+    }
+}
+
+TEST(forward_list, sort)
+{
+    forward_list<int> x { 5, 3, 9, 1, 7, 2, 8, 2, 6, 4 };
+    x.sort();
+    ASSERT_EQ((std::vector<int> { 1, 2, 2, 3, 4, 5, 6, 7, 8, 9 }),
+        to_vector(x));
+    ASSERT_EQ(9, x.back());
+    ASSERT_EQ(10u, x.size());
+    x.push_back(10);
+    ASSERT_EQ(10, x.back());
+
+    x.sort(std::greater<int>());
+    ASSERT_EQ(10, x.front());
+    ASSERT_EQ(1, x.back());
+}
+
+TEST(forward_list, sort_stable)
+{
+    using pair = std::pair<int, int>;
+    forward_list<pair> x;
+    for (int i = 0; i < 100; ++i) x.push_back({ (i * 37) % 7, i });
+    x.sort([](const pair& a, const pair& b) { return a.first < b.first; });
+
+    auto it = x.begin();
+    auto prev = *it;
+    for (++it; it != x.end(); ++it) {
+        ASSERT_LE(prev.first, it->first);
+        if (prev.first == it->first) {
+            ASSERT_LT(prev.second, it->second);
+        }
+        prev = *it;
+    }
+    ASSERT_EQ(100u, x.size());
+}
+
+TEST(forward_list, merge)
+{
+    forward_list<int> x { 1, 3, 5, 7 };
+    forward_list<int> y { 0, 2, 4, 8, 9 };
+    x.merge(y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ(9u, x.size());
+    ASSERT_EQ((std::vector<int> { 0, 1, 2, 3, 4, 5, 7, 8, 9 }),
+        to_vector(x));
+    ASSERT_EQ(9, x.back());
+
+    forward_list<int> z { 10, 11 };
+    z.merge(forward_list<int> { 1, 2 });
+    ASSERT_EQ(11, z.back());
+    z.push_back(12);
+    ASSERT_EQ((std::vector<int> { 1, 2, 10, 11, 12 }), to_vector(z));
+
+    forward_list<int> e;
+    e.merge(z);
+    ASSERT_EQ(5u, e.size());
+    ASSERT_EQ(12, e.back());
+}
+
+TEST(forward_list, unique)
+{
+    forward_list<int> x { 1, 1, 2, 3, 3, 3, 4, 4 };
+    ASSERT_EQ(4u, x.unique());
+    ASSERT_EQ((std::vector<int> { 1, 2, 3, 4 }), to_vector(x));
+    ASSERT_EQ(4, x.back());
+    ASSERT_EQ(4u, x.size());
+}
+
+TEST(forward_list, remove_if)
+{
+    forward_list<int> x { 1, 2, 3, 4, 5, 6 };
+    ASSERT_EQ(3u, x.remove_if([](int v) { return v % 2 == 0; }));
+    ASSERT_EQ((std::vector<int> { 1, 3, 5 }), to_vector(x));
+    ASSERT_EQ(5, x.back());
+    ASSERT_EQ(1u, x.remove(5));
+    ASSERT_EQ(3, x.back());
+    x.push_back(7);
+    ASSERT_EQ((std::vector<int> { 1, 3, 7 }), to_vector(x));
+}
+
+TEST(forward_list, reverse)
+{
+    forward_list<int> x { 1, 2, 3, 4 };
+    x.reverse();
+    ASSERT_EQ((std::vector<int> { 4, 3, 2, 1 }), to_vector(x));
+    ASSERT_EQ(1, x.back());
+    x.push_back(0);
+    ASSERT_EQ(0, x.back());
+    ASSERT_EQ(5u, x.size());
+}
@@ -0,0 +1,52 @@
+#include <cstdint>
+#include "gtest/gtest.h"
+#include <ftl/huge_page_allocator>
+#include <ftl/vector>
+#include <ftl/matrix>
+
+using namespace ftl;
+
+TEST(huge_page_allocator, small_allocation)
+{
+    vector<int, huge_page_allocator<int>> x{ 1, 2, 3 };
+    x.push_back(4);
+    ASSERT_EQ(4, x.size());
+    ASSERT_EQ(4, x.back());
+}
+
+TEST(huge_page_allocator, large_allocation_is_aligned)
+{
+    using alloc_t = huge_page_allocator<std::uint64_t>;
+    const size_t n = 3 * alloc_t::huge_page_size / sizeof(std::uint64_t);
+    vector<std::uint64_t, alloc_t> x;
+    x.resize(n);
+    ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(x.data())
+        % alloc_t::huge_page_size);
+    for (size_t i = 0; i < n; i += 4096) x[i] = i;
+    ASSERT_EQ(4096, x[4096]);
+    ASSERT_EQ(0, x[n - 1]);
+}
+
+TEST(huge_page_allocator, hugetlb_fallback)
+{
+    using alloc_t = huge_page_allocator<char, true>;
+    alloc_t alloc;
+    char* p = alloc.allocate(alloc_t::huge_page_size);
+    ASSERT_NE(nullptr, p);
+    p[0] = 1;
+    p[alloc_t::huge_page_size - 1] = 2;
+    alloc.deallocate(p, alloc_t::huge_page_size);
+}
+
+TEST(huge_page_allocator, matrix)
+{
+    using mat_t = matrix<double, 512, 512, huge_page_allocator<double>>;
+    mat_t a;
+    a.fill(1.0);
+    mat_t b;
+    b.fill(2.0);
+    a += b;
+    ASSERT_EQ(3.0, a(511, 511));
+    ASSERT_TRUE(a == a);
+    ASSERT_TRUE(a != b);
+}
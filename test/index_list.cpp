@@ -0,0 +1,127 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/index_list>
+
+using namespace ftl;
+
+namespace {
+    template <typename L>
+    std::vector<typename L::value_type> to_vector(const L& l)
+    {
+        std::vector<typename L::value_type> v;
+        for (const auto& x : l) v.push_back(x);
+        return v;
+    }
+}
+
+TEST(index_list, construct_default)
+{
+    index_list<int> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(0u, x.capacity());
+    ASSERT_EQ(x.begin(), x.end());
+    ASSERT_EQ(12u, sizeof(index_list<int>::node_type));
+}
+
+TEST(index_list, push_and_pop)
+{
+    index_list<int> x;
+    for (int i = 0; i < 5; ++i) x.push_back(i);
+    x.push_front(-1);
+    ASSERT_EQ(6u, x.size());
+    ASSERT_EQ(-1, x.front());
+    ASSERT_EQ(4, x.back());
+    ASSERT_EQ((std::vector<int> { -1, 0, 1, 2, 3, 4 }), to_vector(x));
+
+    int expected = 4;
+    for (auto it = x.rbegin(); it != x.rend(); ++it) ASSERT_EQ(expected--, *it);
+
+    x.pop_front();
+    x.pop_back();
+    ASSERT_EQ((std::vector<int> { 0, 1, 2, 3 }), to_vector(x));
+}
+
+TEST(index_list, erase_recycles_slots)
+{
+    index_list<std::string> x { "a", "b", "c", "d" };
+    const auto cap = x.capacity();
+    auto it = x.erase(x.begin() + 1);
+    ASSERT_EQ("c", *it);
+    x.erase(x.begin() + 2);
+    x.insert(x.begin(), "e");
+    x.push_back("f");
+    ASSERT_EQ(cap, x.capacity());
+    ASSERT_EQ((std::vector<std::string> { "e", "a", "c", "f" }), to_vector(x));
+}
+
+TEST(index_list, iterators_survive_growth)
+{
+    index_list<int> x { 1 };
+    auto first = x.begin();
+    for (int i = 2; i < 1000; ++i) x.push_back(i);
+    ASSERT_EQ(1, *first);
+    ASSERT_EQ(2, *++first);
+}
+
+TEST(index_list, splice_move_to_front)
+{
+    index_list<int> lru { 1, 2, 3, 4 };
+    lru.splice(lru.begin(), lru, lru.begin() + 2);
+    ASSERT_EQ((std::vector<int> { 3, 1, 2, 4 }), to_vector(lru));
+    lru.splice(lru.begin(), lru, lru.begin() + 3);
+    ASSERT_EQ((std::vector<int> { 4, 3, 1, 2 }), to_vector(lru));
+    ASSERT_EQ(2, lru.back());
+    lru.splice(lru.end(), lru, lru.begin());
+    ASSERT_EQ((std::vector<int> { 3, 1, 2, 4 }), to_vector(lru));
+    ASSERT_EQ(4u, lru.size());
+
+    index_list<int> other { 9, 8 };
+    lru.splice(lru.begin(), other, other.begin());
+    lru.splice(lru.end(), other);
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ((std::vector<int> { 9, 3, 1, 2, 4, 8 }), to_vector(lru));
+}
+
+TEST(index_list, matches_reference_model)
+{
+    index_list<std::string> x;
+    std::vector<std::string> ref;
+    unsigned seed = 11;
+    for (int step = 0; step < 2000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        const size_t pos = ref.empty() ? 0 : (seed >> 8) % (ref.size() + 1);
+        if ((seed >> 4) % 3 != 0 || ref.empty()) {
+            auto s = std::to_string(step);
+            x.insert(x.begin() + pos, s);
+            ref.insert(ref.begin() + pos, s);
+        } else {
+            const size_t e = pos == ref.size() ? pos - 1 : pos;
+            x.erase(x.begin() + e);
+            ref.erase(ref.begin() + e);
+        }
+        ASSERT_EQ(ref.size(), x.size());
+    }
+    ASSERT_EQ(ref, to_vector(x));
+    ASSERT_LT(x.capacity(), 2 * ref.size() + 64);
+}
+
+TEST(index_list, copy_and_move)
+{
+    index_list<std::string> x { "a", "b", "c" };
+    x.erase(x.begin());
+    auto y = x;
+    ASSERT_EQ(x, y);
+    y.push_back("d");
+    ASSERT_NE(x, y);
+    auto z = std::move(y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ((std::vector<std::string> { "b", "c", "d" }), to_vector(z));
+    y = x;
+    swap(y, z);
+    ASSERT_EQ("d", y.back());
+    x.clear();
+    ASSERT_TRUE(x.empty());
+    x.push_back("e");
+    ASSERT_EQ("e", x.front());
+}
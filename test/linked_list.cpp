@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include <ftl/list>
 #include <array>
+#include <vector>
+#include <string>
 
 using namespace ftl;
 
@@ -54,3 +56,183 @@ TEST(linked_list, pop_back)
     list.pop_back();
     ASSERT_EQ(5, list.back());
 }
+
+TEST(linked_list, size_tracks_both_ends)
+{
+    list<int> list;
+    for (int i = 0; i < 10; ++i) list.push_back(i);
+    for (int i = 0; i < 10; ++i) list.push_front(-i);
+    ASSERT_EQ(20, list.size());
+    ASSERT_EQ(-9, list.front());
+    ASSERT_EQ(9, list.back());
+
+    while (!list.empty()) list.pop_back();
+    ASSERT_EQ(0, list.size());
+    list.pop_front();
+    list.emplace_back(3);
+    ASSERT_EQ(3, list.front());
+    ASSERT_EQ(3, list.back());
+}
+
+TEST(linked_list, reverse_iteration)
+{
+    list<int> list { 1, 2, 3, 4 };
+    auto last = list.end();
+    --last;
+    ASSERT_EQ(4, *last);
+
+    std::array<int, 4> expected { 4, 3, 2, 1 };
+    size_t i = 0;
+    for (auto it = list.rbegin(); it != list.rend(); ++it)
+        ASSERT_EQ(expected[i++], *it);
+    ASSERT_EQ(4, i);
+}
+
+TEST(linked_list, move_and_swap)
+{
+    list<std::string> a { "a", "b", "c" };
+    list<std::string> b(std::move(a));
+    ASSERT_TRUE(a.empty());
+    ASSERT_EQ(3, b.size());
+    ASSERT_EQ("c", b.back());
+    a.push_back("x");
+
+    a.swap(b);
+    ASSERT_EQ(3, a.size());
+    ASSERT_EQ(1, b.size());
+    ASSERT_EQ("x", b.front());
+    ASSERT_EQ("a", *a.begin());
+    ASSERT_EQ("c", *--a.end());
+
+    list<std::string> empty;
+    b.swap(empty);
+    ASSERT_TRUE(b.empty());
+    ASSERT_EQ(b.begin(), b.end());
+    ASSERT_EQ("x", empty.back());
+
+    list<std::string> copy(a);
+    ASSERT_EQ(3, copy.size());
+    ASSERT_EQ("b", *++copy.begin());
+}
+
+TEST(linked_list, large_fifo)
+{
+    list<int> fifo;
+    for (int i = 0; i < 100000; ++i) fifo.push_back(i);
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_EQ(i, fifo.front());
+        fifo.pop_front();
+    }
+    ASSERT_TRUE(fifo.empty());
+}
+
+namespace {
+    template <typename L>
+    std::vector<int> to_vector(const L& l)
+    {
+        std::vector<int> v;
+        for (int x : l) v.push_back(x);
+        return v;
+    }
+}
+
+TEST(linked_list, erase)
+{
+    list<int> l { 1, 2, 3, 4, 5 };
+    auto it = l.erase(++l.begin());
+    ASSERT_EQ(3, *it);
+    ASSERT_EQ(4, l.size());
+    it = l.erase(it, --l.end());
+    ASSERT_EQ(5, *it);
+    ASSERT_EQ((std::vector<int>{ 1, 5 }), to_vector(l));
+    l.erase(l.begin(), l.end());
+    ASSERT_TRUE(l.empty());
+}
+
+TEST(linked_list, splice)
+{
+    list<int> a { 1, 2, 3 };
+    list<int> b { 10, 20, 30 };
+    const int* addr = &b.front();
+
+    a.splice(++a.begin(), b);
+    ASSERT_EQ((std::vector<int>{ 1, 10, 20, 30, 2, 3 }), to_vector(a));
+    ASSERT_EQ(6, a.size());
+    ASSERT_TRUE(b.empty());
+    ASSERT_EQ(addr, &*++a.begin());
+
+    b.splice(b.end(), a, --a.end());
+    ASSERT_EQ((std::vector<int>{ 3 }), to_vector(b));
+    ASSERT_EQ(5, a.size());
+
+    b.splice(b.begin(), a, a.begin(), a.begin() + 3);
+    ASSERT_EQ((std::vector<int>{ 1, 10, 20, 3 }), to_vector(b));
+    ASSERT_EQ((std::vector<int>{ 30, 2 }), to_vector(a));
+    ASSERT_EQ(4, b.size());
+    ASSERT_EQ(2, a.size());
+
+    // within the same list
+    b.splice(b.end(), b, b.begin());
+    ASSERT_EQ((std::vector<int>{ 10, 20, 3, 1 }), to_vector(b));
+    b.splice(b.begin(), b, b.begin() + 2, b.end());
+    ASSERT_EQ((std::vector<int>{ 3, 1, 10, 20 }), to_vector(b));
+    ASSERT_EQ(4, b.size());
+}
+
+TEST(linked_list, merge)
+{
+    list<int> a { 1, 4, 4, 9 };
+    list<int> b { 0, 4, 5, 10, 11 };
+    const int* addr = &b.front();
+    a.merge(b);
+    ASSERT_EQ((std::vector<int>{ 0, 1, 4, 4, 4, 5, 9, 10, 11 }), to_vector(a));
+    ASSERT_EQ(9, a.size());
+    ASSERT_TRUE(b.empty());
+    ASSERT_EQ(addr, &a.front());
+
+    list<int> c { 7, 3 };
+    a.merge(c, [](int x, int y) { return x > y; });
+    ASSERT_EQ(11, a.size());
+}
+
+TEST(linked_list, sort)
+{
+    list<int> l;
+    ASSERT_NO_THROW(l.sort());
+    for (int i = 0; i < 1000; ++i) l.push_back((i * 7919) % 1000);
+    l.sort();
+    ASSERT_EQ(1000, l.size());
+    int expected = 0;
+    for (int x : l) ASSERT_EQ(expected++, x);
+    ASSERT_EQ(999, l.back());
+    ASSERT_EQ(998, *----l.end());
+
+    // stability: sort pairs by key only
+    list<std::pair<int, int>> p;
+    for (int i = 0; i < 100; ++i) p.emplace_back(i % 3, i);
+    p.sort([](const auto& x, const auto& y) { return x.first < y.first; });
+    auto prev = p.front();
+    for (const auto& x : p) {
+        if (x.first == prev.first) {
+            ASSERT_LE(prev.second, x.second);
+        }
+        prev = x;
+    }
+}
+
+TEST(linked_list, unique_and_reverse)
+{
+    list<int> l { 1, 1, 2, 2, 2, 3, 1, 1 };
+    ASSERT_EQ(4, l.unique());
+    ASSERT_EQ((std::vector<int>{ 1, 2, 3, 1 }), to_vector(l));
+    ASSERT_EQ(4, l.size());
+
+    l.reverse();
+    ASSERT_EQ((std::vector<int>{ 1, 3, 2, 1 }), to_vector(l));
+    ASSERT_EQ(1, *l.rbegin());
+    ASSERT_EQ(3, *++l.begin());
+
+    list<int> empty;
+    empty.reverse();
+    ASSERT_TRUE(empty.empty());
+}
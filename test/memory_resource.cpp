@@ -0,0 +1,278 @@
+#include "gtest/gtest.h"
+#include <ftl/memory_resource>
+#include <ftl/vector>
+#include <ftl/string>
+#include <ftl/list>
+#include <ftl/forward_list>
+#include <ftl/matrix>
+#include <ftl/deque>
+#include <ftl/ring_buffer>
+#include <ftl/unrolled_list>
+#include <ftl/index_list>
+#include <ftl/segmented_vector>
+#include <cstdint>
+
+using namespace ftl;
+
+namespace {
+    // counts the bytes outstanding in an upstream resource
+    struct counting_resource : memory_resource {
+        std::size_t allocated = 0;
+        std::size_t calls = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            allocated += bytes;
+            ++calls;
+            return new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes,
+            std::size_t alignment) override
+        {
+            allocated -= bytes;
+            new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    bool is_aligned(const void* p, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+}
+
+TEST(memory_resource, default_resource)
+{
+    ASSERT_EQ(new_delete_resource(), get_default_resource());
+    monotonic_buffer_resource arena;
+    ASSERT_EQ(new_delete_resource(), set_default_resource(&arena));
+    ASSERT_EQ(&arena, polymorphic_allocator<int>().resource());
+    set_default_resource(nullptr);
+    ASSERT_EQ(new_delete_resource(), get_default_resource());
+    ASSERT_THROW((void)null_memory_resource()->allocate(1), std::bad_alloc);
+}
+
+TEST(memory_resource, monotonic_chains_blocks)
+{
+    counting_resource upstream;
+    {
+        // 100 bytes, up to 63 bytes of padding and 100 bytes fit in the
+        // first block whatever the alignment of the upstream block
+        monotonic_buffer_resource arena(512, &upstream);
+        void* a = arena.allocate(100, 8);
+        void* b = arena.allocate(100, 64);
+        ASSERT_TRUE(is_aligned(b, 64));
+        ASSERT_NE(a, b);
+        ASSERT_EQ(1, upstream.calls);
+
+        for (int i = 0; i < 100; ++i) (void)arena.allocate(64, 8);
+        ASSERT_LT(upstream.calls, 8);
+        arena.release();
+        ASSERT_EQ(0, upstream.allocated);
+
+        (void)arena.allocate(10000, 8);
+        ASSERT_GE(upstream.allocated, 10000);
+    }
+    ASSERT_EQ(0, upstream.allocated);
+}
+
+TEST(memory_resource, monotonic_initial_buffer)
+{
+    alignas(std::max_align_t) unsigned char buffer[1024];
+    monotonic_buffer_resource arena(buffer, sizeof(buffer),
+        null_memory_resource());
+
+    pmr::vector<int> v(&arena);
+    v.reserve(100);
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    ASSERT_GE(static_cast<void*>(v.data()), static_cast<void*>(buffer));
+    ASSERT_LT(static_cast<void*>(v.data()),
+        static_cast<void*>(buffer + sizeof(buffer)));
+    ASSERT_THROW(v.reserve(1000), std::bad_alloc);
+
+    arena.release();
+    ASSERT_EQ(static_cast<void*>(buffer), arena.allocate(16));
+}
+
+TEST(memory_resource, pool_recycles_blocks)
+{
+    counting_resource upstream;
+    {
+        unsynchronized_pool_resource pool(&upstream);
+        ASSERT_EQ(4096, pool.options().largest_required_pool_block);
+
+        void* a = pool.allocate(24, 8);
+        pool.deallocate(a, 24, 8);
+        ASSERT_EQ(a, pool.allocate(20, 8));
+        ASSERT_TRUE(is_aligned(pool.allocate(32, 32), 32));
+
+        const std::size_t before = upstream.allocated;
+        void* big = pool.allocate(100000, 128);
+        ASSERT_TRUE(is_aligned(big, 128));
+        pool.deallocate(big, 100000, 128);
+        ASSERT_EQ(before, upstream.allocated);
+        (void)pool.allocate(100000);
+
+        pool.release();
+        ASSERT_EQ(0, upstream.allocated);
+        (void)pool.allocate(8);
+    }
+    ASSERT_EQ(0, upstream.allocated);
+}
+
+TEST(memory_resource, pool_options)
+{
+    pool_options opts;
+    opts.largest_required_pool_block = 100;
+    opts.max_blocks_per_chunk = 4;
+    unsynchronized_pool_resource pool(opts);
+    ASSERT_EQ(128, pool.options().largest_required_pool_block);
+    ASSERT_EQ(4, pool.options().max_blocks_per_chunk);
+}
+
+TEST(memory_resource, containers)
+{
+    counting_resource upstream;
+    {
+        monotonic_buffer_resource arena(&upstream);
+
+        pmr::vector<pmr::string> v(&arena);
+        for (int i = 0; i < 20; ++i)
+            v.push_back(pmr::string("a string long enough for the heap", &arena));
+        ASSERT_EQ(20, v.size());
+        ASSERT_EQ(&arena, v.get_allocator().resource());
+
+        pmr::list<int> l(&arena);
+        for (int i = 0; i < 10; ++i) l.push_front(i);
+        ASSERT_EQ(9, l.front());
+
+        pmr::forward_list<int> f(&arena);
+        for (int i = 0; i < 10; ++i) f.push_front(i);
+        ASSERT_EQ(9, f.front());
+        f.clear();
+        ASSERT_TRUE(f.empty());
+        f.push_front(1);
+        ASSERT_EQ(1, f.front());
+
+        pmr::matrix<double, 3, 3> m(&arena);
+        m.fill(1.0);
+        ASSERT_EQ(&arena, m.get_allocator().resource());
+
+        ASSERT_GT(upstream.allocated, 0);
+    }
+    ASSERT_EQ(0, upstream.allocated);
+}
+
+TEST(memory_resource, vector_move_between_resources)
+{
+    unsynchronized_pool_resource a;
+    unsynchronized_pool_resource b;
+    pmr::vector<int> x({ 1, 2, 3 }, &a);
+    pmr::vector<int> y(std::move(x), &b);
+    ASSERT_EQ(&b, y.get_allocator().resource());
+    ASSERT_EQ(3, y.size());
+    ASSERT_EQ(3, y[2]);
+    ASSERT_EQ(0, x.size());
+
+    pmr::vector<int> z(y);
+    ASSERT_EQ(get_default_resource(), z.get_allocator().resource());
+    ASSERT_EQ(y, z);
+}
+
+TEST(memory_resource, copy_assign_keeps_resource)
+{
+    counting_resource a;
+    counting_resource b;
+    {
+        pmr::vector<int> x({ 1, 2, 3 }, &a);
+        pmr::vector<int> y({ 4 }, &b);
+        y = x;
+        ASSERT_EQ(&b, y.get_allocator().resource());
+        ASSERT_EQ(x, y);
+        ASSERT_EQ(3 * sizeof(int), b.allocated);
+
+        pmr::string s("a string long enough for the heap", &a);
+        pmr::string t("short", &b);
+        t = s;
+        ASSERT_EQ(&b, t.get_allocator().resource());
+        ASSERT_EQ(s, t);
+        pmr::string u("short", &a);
+        t = u;
+        ASSERT_EQ(u, t);
+    }
+    ASSERT_EQ(0, a.allocated);
+    ASSERT_EQ(0, b.allocated);
+}
+
+TEST(memory_resource, string_move_and_swap_keep_resources)
+{
+    counting_resource a;
+    counting_resource b;
+    {
+        pmr::string x("a string long enough for the heap", &a);
+        pmr::string y("another string long enough for the heap", &b);
+        y = std::move(x);
+        ASSERT_EQ(&b, y.get_allocator().resource());
+        ASSERT_EQ(pmr::string("a string long enough for the heap"), y);
+
+        pmr::string z("a third string long enough for the heap", &b);
+        y = std::move(z);
+        ASSERT_EQ(pmr::string("a third string long enough for the heap"), y);
+        ASSERT_TRUE(z.empty());
+
+        pmr::string s("short", &b);
+        pmr::string t("yet another string long enough for the heap", &b);
+        s.swap(t);
+        ASSERT_EQ(pmr::string("short"), t);
+        ASSERT_EQ(&b, s.get_allocator().resource());
+
+        pmr::string u(std::move(s), &a);
+        ASSERT_EQ(pmr::string("yet another string long enough for the heap"), u);
+
+        x = "assigned from a literal long enough for the heap";
+        ASSERT_EQ(&a, x.get_allocator().resource());
+    }
+    ASSERT_EQ(0, a.allocated);
+    ASSERT_EQ(0, b.allocated);
+}
+
+namespace {
+    template <typename C>
+    void check_copy_assign(memory_resource* a, memory_resource* b)
+    {
+        C x({ 1, 2, 3 }, a);
+        C y({ 4 }, b);
+        y = x;
+        ASSERT_EQ(b, y.get_allocator().resource());
+        ASSERT_EQ(3, distance(y.begin(), y.end()));
+        ASSERT_EQ(1, *y.begin());
+    }
+}
+
+TEST(memory_resource, copy_assign_keeps_resource_in_all_containers)
+{
+    counting_resource a;
+    counting_resource b;
+    check_copy_assign<pmr::list<int>>(&a, &b);
+    check_copy_assign<pmr::forward_list<int>>(&a, &b);
+    check_copy_assign<pmr::deque<int>>(&a, &b);
+    check_copy_assign<pmr::ring_buffer<int>>(&a, &b);
+    check_copy_assign<pmr::unrolled_list<int>>(&a, &b);
+    check_copy_assign<pmr::index_list<int>>(&a, &b);
+    check_copy_assign<segmented_vector<int, 16, polymorphic_allocator<int>>>(
+        &a, &b);
+    {
+        pmr::matrix<int, 2, 2> x({ 1, 2, 3, 4 }, &a);
+        pmr::matrix<int, 2, 2> y(&b);
+        y = x;
+        ASSERT_EQ(&b, y.get_allocator().resource());
+        ASSERT_EQ(4, y(1, 1));
+    }
+    ASSERT_EQ(0, a.allocated);
+    ASSERT_EQ(0, b.allocated);
+}
@@ -0,0 +1,113 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/mpmc_queue>
+
+using namespace ftl;
+
+TEST(mpmc_queue, capacity_is_power_of_two)
+{
+    mpmc_queue<int> q(100);
+    ASSERT_EQ(128u, q.capacity());
+    mpmc_queue<int> r(1);
+    ASSERT_EQ(2u, r.capacity());
+    ASSERT_TRUE(r.empty());
+}
+
+TEST(mpmc_queue, cells_are_padded)
+{
+    ASSERT_EQ(cache_line_size, alignof(mpmc_cell<int>));
+    ASSERT_EQ(cache_line_size, sizeof(mpmc_cell<int>));
+}
+
+TEST(mpmc_queue, push_pop)
+{
+    mpmc_queue<std::string> q(4);
+    ASSERT_TRUE(q.try_push("a"));
+    ASSERT_TRUE(q.try_emplace(3, 'b'));
+    ASSERT_EQ(2u, q.size());
+
+    std::string s;
+    ASSERT_TRUE(q.try_pop(s));
+    ASSERT_EQ("a", s);
+    q.pop(s);
+    ASSERT_EQ("bbb", s);
+    ASSERT_FALSE(q.try_pop(s));
+    ASSERT_EQ("bbb", s);
+}
+
+TEST(mpmc_queue, full)
+{
+    mpmc_queue<int> q(4);
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 4; ++i) ASSERT_TRUE(q.try_push(i));
+        ASSERT_FALSE(q.try_push(4));
+        for (int i = 0; i < 4; ++i) {
+            int x = -1;
+            ASSERT_TRUE(q.try_pop(x));
+            ASSERT_EQ(i, x);
+        }
+        ASSERT_TRUE(q.empty());
+    }
+}
+
+TEST(mpmc_queue, destroys_remaining)
+{
+    auto p = std::make_shared<int>(1);
+    {
+        mpmc_queue<std::shared_ptr<int>> q(4);
+        q.push(p);
+        q.push(p);
+        q.push(p);
+        std::shared_ptr<int> x;
+        q.pop(x);
+        x.reset();
+        ASSERT_EQ(3, p.use_count());
+    }
+    ASSERT_EQ(1, p.use_count());
+}
+
+TEST(mpmc_queue, many_threads)
+{
+    constexpr int producers = 4, consumers = 4, count = 20000;
+    mpmc_queue<int> q(64);
+    std::atomic<long long> sum{ 0 };
+    std::atomic<int> popped{ 0 };
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < count; ++i) {
+                if (i % 2) {
+                    q.push(t * count + i);
+                } else {
+                    while (!q.try_push(t * count + i))
+                        std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int t = 0; t < consumers; ++t) {
+        threads.emplace_back([&] {
+            long long local = 0;
+            while (popped.load() < producers * count) {
+                int x;
+                if (q.try_pop(x)) {
+                    local += x;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sum += local;
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    const long long n = producers * count;
+    ASSERT_EQ(n * (n - 1) / 2, sum.load());
+    ASSERT_TRUE(q.empty());
+}
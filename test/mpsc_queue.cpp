@@ -0,0 +1,101 @@
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/mpsc_queue>
+
+using namespace ftl;
+
+namespace {
+    struct event : mpsc_node {
+        int source = 0;
+        int value = 0;
+    };
+}
+
+TEST(mpsc_queue, empty)
+{
+    mpsc_queue<event> q;
+    ASSERT_EQ(nullptr, q.pop());
+    ASSERT_EQ(nullptr, q.pop());
+}
+
+TEST(mpsc_queue, fifo)
+{
+    mpsc_queue<event> q;
+    event e[4];
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            e[i].value = round * 4 + i;
+            q.push(&e[i]);
+        }
+        for (int i = 0; i < 4; ++i) {
+            event* p = q.pop();
+            ASSERT_EQ(&e[i], p);
+            ASSERT_EQ(round * 4 + i, p->value);
+        }
+        ASSERT_EQ(nullptr, q.pop());
+    }
+}
+
+TEST(mpsc_queue, interleaved)
+{
+    mpsc_queue<event> q;
+    event a, b, c;
+    q.push(&a);
+    ASSERT_EQ(&a, q.pop());
+    q.push(&b);
+    q.push(&a);
+    ASSERT_EQ(&b, q.pop());
+    q.push(&c);
+    ASSERT_EQ(&a, q.pop());
+    ASSERT_EQ(&c, q.pop());
+    ASSERT_EQ(nullptr, q.pop());
+}
+
+TEST(mpsc_queue, consume_all)
+{
+    mpsc_queue<event> q;
+    event e[5];
+    for (int i = 0; i < 5; ++i) {
+        e[i].value = i;
+        q.push(&e[i]);
+    }
+    std::vector<int> got;
+    ASSERT_EQ(5u, q.consume_all([&](event* p) { got.push_back(p->value); }));
+    ASSERT_EQ((std::vector<int>{ 0, 1, 2, 3, 4 }), got);
+    ASSERT_EQ(0u, q.consume_all([](event*) {}));
+}
+
+TEST(mpsc_queue, many_producers)
+{
+    constexpr int producers = 4, count = 20000;
+    mpsc_queue<event> q;
+    std::vector<event> events(producers * count);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < count; ++i) {
+                event& e = events[t * count + i];
+                e.source = t;
+                e.value = i;
+                q.push(&e);
+            }
+        });
+    }
+
+    std::vector<int> next(producers, 0);
+    int received = 0;
+    while (received < producers * count) {
+        const size_t n = q.consume_all([&](event* p) {
+            ASSERT_EQ(next[p->source], p->value);
+            ++next[p->source];
+        });
+        if (n == 0) std::this_thread::yield();
+        received += static_cast<int>(n);
+    }
+    for (auto& t : threads) t.join();
+
+    ASSERT_EQ(nullptr, q.pop());
+    for (int t = 0; t < producers; ++t) ASSERT_EQ(count, next[t]);
+}
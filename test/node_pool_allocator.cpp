@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include <ftl/node_pool_allocator>
+#include <ftl/list>
+#include <ftl/forward_list>
+#include <cstdint>
+
+using namespace ftl;
+
+TEST(node_pool_allocator, recycles_nodes)
+{
+    node_pool_allocator<std::uint64_t, 16> alloc;
+    std::uint64_t* a = alloc.allocate(1);
+    std::uint64_t* b = alloc.allocate(1);
+    ASSERT_EQ(a + 1, b);
+    ASSERT_EQ(14, alloc.free_nodes());
+
+    alloc.deallocate(a, 1);
+    ASSERT_EQ(a, alloc.allocate(1));
+
+    std::uint64_t* arr = alloc.allocate(100);
+    arr[99] = 1;
+    alloc.deallocate(arr, 100);
+    alloc.deallocate(a, 1);
+    alloc.deallocate(b, 1);
+    ASSERT_EQ(16, alloc.free_nodes());
+}
+
+TEST(node_pool_allocator, copies_share_slabs)
+{
+    node_pool_allocator<int> a;
+    node_pool_allocator<int> b(a);
+    node_pool_allocator<double> c(a);
+    node_pool_allocator<int> d;
+    ASSERT_TRUE(a == b);
+    ASSERT_TRUE(a == c);
+    ASSERT_TRUE(a != d);
+
+    int* p = a.allocate(1);
+    b.deallocate(p, 1);
+    ASSERT_EQ(p, b.allocate(1));
+    a.deallocate(p, 1);
+
+    node_pool_allocator<int> e(c);
+    ASSERT_TRUE(e == a);
+}
+
+TEST(node_pool_allocator, reserve)
+{
+    node_pool_allocator<int, 64> alloc;
+    alloc.reserve(100);
+    ASSERT_EQ(128, alloc.free_nodes());
+    alloc.reserve(10);
+    ASSERT_EQ(128, alloc.free_nodes());
+}
+
+TEST(node_pool_allocator, list_nodes)
+{
+    list<int, node_pool_allocator<dl_node<int>>> l;
+    l.reserve_nodes(1000);
+    const auto reserved = l.get_allocator().free_nodes();
+    ASSERT_GE(reserved, 1000);
+
+    for (int i = 0; i < 1000; ++i) l.push_front(i);
+    ASSERT_EQ(1000, l.size());
+    ASSERT_EQ(reserved - 1000, l.get_allocator().free_nodes());
+    l.clear();
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(reserved, l.get_allocator().free_nodes());
+
+    list<int> plain;
+    plain.reserve_nodes(10);
+    ASSERT_TRUE(plain.empty());
+}
+
+TEST(node_pool_allocator, forward_list_nodes)
+{
+    forward_list<int, node_pool_allocator<fwd_list_node<int>>> l;
+    l.reserve_nodes(100);
+    for (int i = 0; i < 100; ++i) l.push_front(i);
+    ASSERT_EQ(99, l.front());
+    ASSERT_EQ(100, distance(l.begin(), l.end()));
+}
+
+TEST(node_pool_allocator, moved_from_container)
+{
+    using alloc_type = node_pool_allocator<fwd_list_node<int>>;
+    forward_list<int, alloc_type> l;
+    l.push_front(1);
+
+    forward_list<int, alloc_type> m(std::move(l));
+    l.push_front(2);
+    ASSERT_EQ(2, l.front());
+    ASSERT_EQ(1, m.front());
+    ASSERT_TRUE(l.get_allocator() == m.get_allocator());
+
+    alloc_type a;
+    alloc_type b(std::move(a));
+    alloc_type c;
+    c = std::move(b);
+    fwd_list_node<int>* p = a.allocate(1);
+    b.deallocate(p, 1);
+    ASSERT_EQ(p, c.allocate(1));
+    c.deallocate(p, 1);
+}
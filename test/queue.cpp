@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <ftl/queue>
+#include <ftl/deque>
+#include <ftl/list>
+#include <string>
 
 using namespace ftl;
 
@@ -18,7 +21,30 @@ TEST(queue, construct_with_list)
     l.push_front(2);
     l.push_front(1);
 
-    queue<int> q(l);
+    queue<int, list<int>> q(l);
     ASSERT_EQ(q.front(), 1);
     ASSERT_EQ(q.back(), 5);
 }
+
+TEST(queue, deque_container)
+{
+    queue<int, deque<int>> q;
+    for (int i = 0; i < 1000; ++i) q.push(i);
+    for (int i = 0; i < 500; ++i) q.pop();
+    ASSERT_EQ(500u, q.size());
+    ASSERT_EQ(500, q.front());
+    ASSERT_EQ(999, q.back());
+}
+
+TEST(queue, ring_buffer_default)
+{
+    queue<std::string> q;
+    for (int round = 0; round < 100; ++round) {
+        q.push(std::to_string(round));
+        q.emplace(std::to_string(round + 1));
+        ASSERT_EQ(std::to_string(round + 1), q.back());
+        q.pop();
+    }
+    ASSERT_EQ(100u, q.size());
+    ASSERT_EQ("50", q.front());
+}
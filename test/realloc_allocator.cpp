@@ -0,0 +1,57 @@
+#include <string>
+#include "gtest/gtest.h"
+#include <ftl/realloc_allocator>
+#include <ftl/vector>
+#include <ftl/string>
+
+using namespace ftl;
+
+TEST(realloc_allocator, has_try_expand)
+{
+    static_assert(has_try_expand<realloc_allocator<int>>::value);
+    static_assert(!has_try_expand<std::allocator<int>>::value);
+}
+
+TEST(realloc_allocator, vector_growth)
+{
+    vector<int, realloc_allocator<int>> x;
+    for (int i = 0; i < 100000; ++i) x.push_back(i);
+    ASSERT_EQ(100000, x.size());
+    for (int i = 0; i < 100000; ++i) ASSERT_EQ(i, x[i]);
+}
+
+TEST(realloc_allocator, vector_growth_past_map_threshold)
+{
+    const size_t n = realloc_allocator<int>::map_threshold / sizeof(int);
+    vector<int, realloc_allocator<int>> x;
+    x.reserve(n / 2);
+    for (size_t i = 0; i < 2 * n; ++i) x.push_back(static_cast<int>(i));
+    ASSERT_EQ(2 * n, x.size());
+    ASSERT_EQ(0, x.front());
+    ASSERT_EQ(static_cast<int>(n), x[n]);
+    ASSERT_EQ(static_cast<int>(2 * n - 1), x.back());
+}
+
+TEST(realloc_allocator, vector_self_push_back)
+{
+    vector<int, realloc_allocator<int>> x{ 42 };
+    for (int i = 0; i < 20; ++i) x.push_back(x[0]);
+    ASSERT_EQ(42, x.back());
+}
+
+TEST(realloc_allocator, vector_non_trivial)
+{
+    vector<std::string, realloc_allocator<std::string>> x;
+    for (int i = 0; i < 100; ++i) x.push_back(std::to_string(i));
+    ASSERT_EQ("99", x.back());
+}
+
+TEST(realloc_allocator, string_reserve)
+{
+    basic_string<char, realloc_allocator<char>> str(
+        "This is a long string used to test heap allocation");
+    str.reserve(1000);
+    ASSERT_EQ(1000, str.capacity());
+    ASSERT_EQ('T', str.front());
+    ASSERT_EQ('n', str.back());
+}
@@ -0,0 +1,171 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/ring_buffer>
+
+using namespace ftl;
+
+TEST(ring_buffer, construct_default)
+{
+    ring_buffer<int> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(0u, x.capacity());
+    ASSERT_EQ(x.begin(), x.end());
+}
+
+TEST(ring_buffer, construct_with_ilist)
+{
+    ring_buffer<int> x { 1, 2, 3, 4, 5 };
+    ASSERT_EQ(5u, x.size());
+    ASSERT_EQ(8u, x.capacity());
+    ASSERT_EQ(1, x.front());
+    ASSERT_EQ(5, x.back());
+}
+
+TEST(ring_buffer, capacity_is_power_of_two)
+{
+    ring_buffer<int> x(100, ring_buffer_mode::refuse);
+    ASSERT_EQ(128u, x.capacity());
+    x.reserve(129);
+    ASSERT_EQ(256u, x.capacity());
+}
+
+TEST(ring_buffer, wraps_and_grows)
+{
+    ring_buffer<std::string> x;
+    int next = 0, expect = 0;
+    for (int round = 0; round < 200; ++round) {
+        x.push_back(std::to_string(next++));
+        x.push_back(std::to_string(next++));
+        x.push_back(std::to_string(next++));
+        ASSERT_EQ(std::to_string(expect++), x.front());
+        x.pop_front();
+        ASSERT_EQ(std::to_string(expect++), x.front());
+        x.pop_front();
+    }
+    ASSERT_EQ(200u, x.size());
+    ASSERT_EQ(256u, x.capacity());
+    for (size_t i = 0; i < x.size(); ++i)
+        ASSERT_EQ(std::to_string(expect + static_cast<int>(i)), x[i]);
+}
+
+TEST(ring_buffer, push_front)
+{
+    ring_buffer<int> x;
+    for (int i = 0; i < 20; ++i) {
+        x.push_front(i);
+        x.push_back(100 + i);
+    }
+    ASSERT_EQ(40u, x.size());
+    ASSERT_EQ(19, x.front());
+    ASSERT_EQ(119, x.back());
+
+    std::vector<int> v;
+    for (auto it = x.begin(); it != x.end(); ++it) v.push_back(*it);
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_EQ(19 - i, v[i]);
+        ASSERT_EQ(100 + i, v[20 + i]);
+    }
+
+    v.clear();
+    for (auto it = x.rbegin(); it != x.rend(); ++it) v.push_back(*it);
+    ASSERT_EQ(119, v.front());
+    ASSERT_EQ(19, v.back());
+}
+
+TEST(ring_buffer, overwrite)
+{
+    ring_buffer<int> x(4, ring_buffer_mode::overwrite);
+    for (int i = 0; i < 10; ++i) x.push_back(i);
+    ASSERT_EQ(4u, x.capacity());
+    ASSERT_TRUE(x.full());
+    ASSERT_EQ(6, x.front());
+    ASSERT_EQ(9, x.back());
+
+    x.push_front(42);
+    ASSERT_EQ(42, x.front());
+    ASSERT_EQ(8, x.back());
+}
+
+TEST(ring_buffer, overwrite_aliased)
+{
+    ring_buffer<std::string> x(2, ring_buffer_mode::overwrite);
+    x.push_back("first");
+    x.push_back("second");
+    x.push_back(x.front());
+    ASSERT_EQ("second", x.front());
+    ASSERT_EQ("first", x.back());
+}
+
+TEST(ring_buffer, grow_aliased)
+{
+    ring_buffer<std::string> x;
+    for (int i = 0; i < 8; ++i) x.push_back(std::to_string(i));
+    ASSERT_TRUE(x.full());
+    x.push_back(x.front());
+    x.push_front(x.back());
+    ASSERT_EQ(10u, x.size());
+    ASSERT_EQ("0", x.front());
+    ASSERT_EQ("0", x.back());
+    ASSERT_EQ("7", x[8]);
+}
+
+TEST(ring_buffer, refuse)
+{
+    ring_buffer<int> x(2, ring_buffer_mode::refuse);
+    ASSERT_TRUE(x.try_push_back(1));
+    ASSERT_TRUE(x.try_push_front(0));
+    ASSERT_FALSE(x.try_push_back(2));
+    ASSERT_FALSE(x.try_emplace_front(-1));
+    ASSERT_THROW(x.push_back(2), ring_buffer_full);
+    ASSERT_EQ(2u, x.size());
+    ASSERT_EQ(0, x[0]);
+    ASSERT_EQ(1, x[1]);
+
+    x.pop_front();
+    ASSERT_TRUE(x.try_push_back(2));
+    ASSERT_EQ(1, x.front());
+    ASSERT_EQ(2, x.back());
+}
+
+TEST(ring_buffer, pop_back)
+{
+    ring_buffer<int> x { 1, 2, 3 };
+    x.pop_back();
+    ASSERT_EQ(2, x.back());
+    x.pop_back();
+    x.pop_back();
+    ASSERT_TRUE(x.empty());
+    x.pop_back();
+    ASSERT_TRUE(x.empty());
+}
+
+TEST(ring_buffer, at)
+{
+    ring_buffer<int> x { 1, 2, 3 };
+    ASSERT_EQ(3, x.at(2));
+    ASSERT_THROW(x.at(3), array_out_of_range);
+}
+
+TEST(ring_buffer, copy_move_swap)
+{
+    ring_buffer<std::string> x(8, ring_buffer_mode::overwrite);
+    for (int i = 0; i < 12; ++i) x.push_back(std::to_string(i));
+
+    ring_buffer<std::string> y(x);
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(ring_buffer_mode::overwrite, y.mode());
+
+    ring_buffer<std::string> z(std::move(y));
+    ASSERT_EQ(x, z);
+    ASSERT_TRUE(y.empty());
+
+    ring_buffer<std::string> w { "a" };
+    swap(w, z);
+    ASSERT_EQ(x, w);
+    ASSERT_EQ(1u, z.size());
+    ASSERT_NE(x, z);
+
+    z = x;
+    ASSERT_EQ(x, z);
+}
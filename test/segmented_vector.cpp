@@ -0,0 +1,76 @@
+#include <string>
+#include "gtest/gtest.h"
+#include <ftl/segmented_vector>
+
+using namespace ftl;
+
+TEST(segmented_vector, construct_default)
+{
+    segmented_vector<int> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(0, x.capacity());
+}
+
+TEST(segmented_vector, construct_with_ilist)
+{
+    segmented_vector<int, 2> x{ 1, 2, 3, 4, 5 };
+    ASSERT_EQ(5, x.size());
+    ASSERT_EQ(6, x.capacity());
+    ASSERT_EQ(1, x.front());
+    ASSERT_EQ(5, x.back());
+    ASSERT_EQ(3, x[2]);
+    ASSERT_THROW(x.at(5), array_out_of_range);
+}
+
+TEST(segmented_vector, stable_references)
+{
+    segmented_vector<std::string, 4> x;
+    x.push_back("first");
+    const std::string* first = &x[0];
+    for (int i = 0; i < 1000; ++i) x.emplace_back(std::to_string(i));
+    ASSERT_EQ(first, &x[0]);
+    ASSERT_EQ("first", *first);
+    ASSERT_EQ("999", x.back());
+}
+
+TEST(segmented_vector, iterators)
+{
+    segmented_vector<int, 3> x;
+    for (int i = 0; i < 10; ++i) x.push_back(i);
+    int expected = 0;
+    for (auto it = x.begin(); it != x.end(); ++it) ASSERT_EQ(expected++, *it);
+    ASSERT_EQ(10, x.end() - x.begin());
+    ASSERT_EQ(7, *(x.begin() + 7));
+
+    expected = 9;
+    for (auto it = x.rbegin(); it != x.rend(); ++it) ASSERT_EQ(expected--, *it);
+
+    const auto& cx = x;
+    expected = 0;
+    for (auto v : cx) ASSERT_EQ(expected++, v);
+}
+
+TEST(segmented_vector, pop_back_and_shrink)
+{
+    segmented_vector<int, 4> x{ 1, 2, 3, 4, 5, 6 };
+    x.pop_back();
+    x.pop_back();
+    x.pop_back();
+    ASSERT_EQ(3, x.size());
+    ASSERT_EQ(8, x.capacity());
+    x.shrink_to_fit();
+    ASSERT_EQ(4, x.capacity());
+    ASSERT_EQ(3, x.back());
+}
+
+TEST(segmented_vector, copy_and_move)
+{
+    segmented_vector<std::string, 2> x{ "a", "b", "c" };
+    auto y = x;
+    ASSERT_EQ(x, y);
+    auto z = std::move(y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ(x, z);
+    z.push_back("d");
+    ASSERT_NE(x, z);
+}
@@ -0,0 +1,157 @@
+#include <string>
+#include "gtest/gtest.h"
+#include <ftl/small_vector>
+#include <ftl/memory_resource>
+
+using namespace ftl;
+
+TEST(small_vector, construct_default)
+{
+    small_vector<int, 8> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_TRUE(x.is_small());
+    ASSERT_EQ(8, x.capacity());
+}
+
+TEST(small_vector, construct_with_count_and_value)
+{
+    small_vector<int, 4> x(5, 3);
+    ASSERT_EQ(5, x.size());
+    ASSERT_FALSE(x.is_small());
+    ASSERT_EQ(3, x.front());
+    ASSERT_EQ(3, x.back());
+}
+
+TEST(small_vector, construct_with_ilist)
+{
+    small_vector<int, 4> x{ 1, 2, 3 };
+    ASSERT_EQ(3, x.size());
+    ASSERT_TRUE(x.is_small());
+    ASSERT_EQ(1, x.front());
+    ASSERT_EQ(3, x.back());
+}
+
+TEST(small_vector, spill_to_heap)
+{
+    small_vector<std::string, 2> x;
+    x.push_back("first string, long enough to skip SSO");
+    x.push_back("second");
+    ASSERT_TRUE(x.is_small());
+    x.push_back("third");
+    ASSERT_FALSE(x.is_small());
+    ASSERT_EQ(3, x.size());
+    ASSERT_EQ("first string, long enough to skip SSO", x[0]);
+    ASSERT_EQ("third", x[2]);
+
+    x.pop_back();
+    x.shrink_to_fit();
+    ASSERT_TRUE(x.is_small());
+    ASSERT_EQ("second", x.back());
+}
+
+TEST(small_vector, copy_and_move)
+{
+    small_vector<std::string, 2> small{ "a", "b" };
+    small_vector<std::string, 2> big{ "a", "b", "c" };
+
+    auto small_copy = small;
+    auto big_copy = big;
+    ASSERT_EQ(small, small_copy);
+    ASSERT_EQ(big, big_copy);
+
+    auto small_moved = std::move(small_copy);
+    auto big_moved = std::move(big_copy);
+    ASSERT_TRUE(small_copy.empty());
+    ASSERT_TRUE(big_copy.empty());
+    ASSERT_EQ(small, small_moved);
+    ASSERT_EQ(big, big_moved);
+
+    small_moved.swap(big_moved);
+    ASSERT_EQ(big, small_moved);
+    ASSERT_EQ(small, big_moved);
+}
+
+TEST(small_vector, at)
+{
+    small_vector<int, 2> x{ 1, 2, 3 };
+    ASSERT_THROW(x.at(3), array_out_of_range);
+    ASSERT_EQ(3, x.at(2));
+}
+
+TEST(small_vector, resize)
+{
+    small_vector<int, 4> x;
+    x.resize(3);
+    ASSERT_TRUE(x.is_small());
+    ASSERT_EQ(0, x[2]);
+    x.resize(10);
+    ASSERT_FALSE(x.is_small());
+    ASSERT_EQ(10, x.size());
+    x.resize(1);
+    ASSERT_EQ(1, x.size());
+}
+
+TEST(small_vector, iter_traversal)
+{
+    small_vector<int, 4> x{ 1, 1, 1, 1, 1 };
+    for (auto it = x.begin(); it != x.end(); ++it)
+        ASSERT_EQ(1, *it);
+}
+
+namespace {
+    // counts the bytes outstanding in an upstream resource
+    struct counting_resource : memory_resource {
+        std::size_t allocated = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            allocated += bytes;
+            return new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes,
+            std::size_t alignment) override
+        {
+            allocated -= bytes;
+            new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST(small_vector, assign_between_resources)
+{
+    using pmr_small_vector =
+        small_vector<std::string, 2, polymorphic_allocator<std::string>>;
+    counting_resource a;
+    counting_resource b;
+    {
+        pmr_small_vector x({ "one", "two", "three" }, &a);
+        pmr_small_vector y(&b);
+        y = std::move(x);
+        ASSERT_EQ(&b, y.get_allocator().resource());
+        ASSERT_TRUE(x.empty());
+        ASSERT_EQ(0, a.allocated);
+        ASSERT_EQ(3, y.size());
+        ASSERT_EQ("three", y[2]);
+
+        pmr_small_vector z({ "four", "five", "six" }, &b);
+        y = std::move(z);
+        ASSERT_EQ("six", y[2]);
+
+        pmr_small_vector c(y);
+        ASSERT_EQ(get_default_resource(), c.get_allocator().resource());
+
+        pmr_small_vector w(&a);
+        w = y;
+        ASSERT_EQ(&a, w.get_allocator().resource());
+        ASSERT_EQ(y, w);
+        ASSERT_GT(a.allocated, 0);
+    }
+    ASSERT_EQ(0, a.allocated);
+    ASSERT_EQ(0, b.allocated);
+}
@@ -0,0 +1,107 @@
+#include <string>
+#include "gtest/gtest.h"
+#include <ftl/soa_vector>
+
+using namespace ftl;
+
+TEST(soa_vector, construct_default)
+{
+    soa_vector<int, double> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(0, x.capacity());
+}
+
+TEST(soa_vector, push_back_and_columns)
+{
+    soa_vector<int, double, std::string> x;
+    for (int i = 0; i < 100; ++i)
+        x.push_back(i, i * 0.5, std::to_string(i));
+    ASSERT_EQ(100, x.size());
+
+    const int* ids = x.column<0>();
+    const double* scores = x.column<1>();
+    double sum = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        ASSERT_EQ(static_cast<int>(i), ids[i]);
+        sum += scores[i];
+    }
+    ASSERT_DOUBLE_EQ(2475.0, sum);
+    ASSERT_EQ("42", std::get<2>(x[42]));
+}
+
+TEST(soa_vector, row_references)
+{
+    soa_vector<int, double> x;
+    x.emplace_back(1, 1.0);
+    x.emplace_back(2, 2.0);
+    std::get<1>(x[1]) = 5.0;
+    ASSERT_EQ(5.0, x.column<1>()[1]);
+
+    auto [id, score] = x.back();
+    id = 7;
+    ASSERT_EQ(7, x.column<0>()[1]);
+    (void)score;
+    ASSERT_THROW(x.at(2), array_out_of_range);
+}
+
+TEST(soa_vector, iterators)
+{
+    soa_vector<int, int> x;
+    for (int i = 0; i < 10; ++i) x.push_back(i, -i);
+    int expected = 0;
+    for (auto row : x) {
+        ASSERT_EQ(expected, std::get<0>(row));
+        ASSERT_EQ(-expected, std::get<1>(row));
+        ++expected;
+    }
+    ASSERT_EQ(10, x.end() - x.begin());
+    ASSERT_EQ(9, std::get<0>(*x.rbegin()));
+}
+
+TEST(soa_vector, random_access_iterators)
+{
+    soa_vector<int, int> x;
+    for (int i = 0; i < 10; ++i) x.push_back(i, -i);
+
+    auto it = x.begin();
+    it += 7;
+    ASSERT_EQ(7, std::get<0>(*it));
+    it -= 2;
+    ASSERT_EQ(-8, std::get<1>(it[3]));
+    std::get<1>(it[3]) = 80;
+    ASSERT_EQ(80, std::get<1>(x[8]));
+    ASSERT_EQ(x.begin() + 5, 5 + x.begin());
+
+    ASSERT_TRUE(x.begin() < it);
+    ASSERT_TRUE(it > x.begin());
+    ASSERT_TRUE(it <= it);
+    ASSERT_TRUE(x.end() >= it);
+
+    const auto& cx = x;
+    auto cit = cx.begin();
+    cit += 9;
+    ASSERT_EQ(9, std::get<0>(*cit));
+    ASSERT_EQ(1, std::get<0>(cit[-8]));
+    ASSERT_EQ(9, cit - cx.begin());
+}
+
+TEST(soa_vector, resize_copy_move)
+{
+    soa_vector<int, std::string> x;
+    x.resize(3);
+    ASSERT_EQ(0, x.column<0>()[2]);
+    ASSERT_TRUE(x.column<1>()[2].empty());
+    x.push_back(4, "four");
+
+    auto y = x;
+    ASSERT_EQ(4, y.size());
+    ASSERT_EQ("four", x.column<1>()[3]);
+
+    auto z = std::move(y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ("four", std::get<1>(z.back()));
+
+    z.pop_back();
+    z.shrink_to_fit();
+    ASSERT_EQ(3, z.capacity());
+}
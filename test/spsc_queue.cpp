@@ -0,0 +1,127 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/spsc_queue>
+
+using namespace ftl;
+
+TEST(spsc_queue, capacity_is_power_of_two)
+{
+    spsc_queue<int> q(100);
+    ASSERT_EQ(128u, q.capacity());
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(spsc_queue, push_pop)
+{
+    spsc_queue<std::string> q(4);
+    ASSERT_TRUE(q.try_push("a"));
+    ASSERT_TRUE(q.try_emplace(3, 'b'));
+    ASSERT_EQ(2u, q.size());
+
+    std::string s;
+    ASSERT_TRUE(q.try_pop(s));
+    ASSERT_EQ("a", s);
+    ASSERT_EQ("bbb", *q.front());
+    q.pop();
+    ASSERT_EQ(nullptr, q.front());
+    ASSERT_FALSE(q.try_pop(s));
+    ASSERT_EQ("a", s);
+}
+
+TEST(spsc_queue, full)
+{
+    spsc_queue<int> q(4);
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 4; ++i) ASSERT_TRUE(q.try_push(i));
+        ASSERT_FALSE(q.try_push(4));
+        for (int i = 0; i < 3; ++i) {
+            int x = -1;
+            ASSERT_TRUE(q.try_pop(x));
+            ASSERT_EQ(i, x);
+        }
+        ASSERT_TRUE(q.try_push(4));
+        ASSERT_EQ(3, *q.front());
+        q.pop();
+        ASSERT_EQ(4, *q.front());
+        q.pop();
+    }
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(spsc_queue, bulk)
+{
+    spsc_queue<int> q(8);
+    int in[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int out[11] = {};
+
+    ASSERT_EQ(5u, q.push_bulk(in, 5));
+    ASSERT_EQ(3u, q.pop_bulk(out, 3));
+    ASSERT_EQ(5u, q.push_bulk(in + 5, 5));
+    ASSERT_EQ(1u, q.push_bulk(in, 5));
+    ASSERT_EQ(8u, q.size());
+    ASSERT_EQ(0u, q.push_bulk(in, 1));
+
+    ASSERT_EQ(8u, q.pop_bulk(out + 3, 10));
+    for (int i = 0; i < 10; ++i) ASSERT_EQ(i, out[i]);
+    ASSERT_EQ(0, out[10]);
+    ASSERT_EQ(0u, q.pop_bulk(out, 1));
+}
+
+TEST(spsc_queue, destroys_remaining)
+{
+    auto p = std::make_shared<int>(1);
+    {
+        spsc_queue<std::shared_ptr<int>> q(4);
+        q.try_push(p);
+        q.try_push(p);
+        q.try_push(p);
+        q.pop();
+        ASSERT_EQ(3, p.use_count());
+    }
+    ASSERT_EQ(1, p.use_count());
+}
+
+TEST(spsc_queue, two_threads)
+{
+    constexpr int count = 200000;
+    spsc_queue<int> q(64);
+
+    std::thread producer([&] {
+        for (int i = 0; i < count;) {
+            if (i % 3 == 0) {
+                int batch[16];
+                for (int j = 0; j < 16; ++j) batch[j] = i + j;
+                const int n = count - i < 16 ? count - i : 16;
+                const int pushed = static_cast<int>(q.push_bulk(batch, n));
+                if (pushed == 0) std::this_thread::yield();
+                i += pushed;
+            } else if (q.try_push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<int> got;
+    got.reserve(count);
+    while (static_cast<int>(got.size()) < count) {
+        int batch[16];
+        if (got.size() % 2 == 0) {
+            const size_t n = q.pop_bulk(batch, 16);
+            if (n == 0) std::this_thread::yield();
+            got.insert(got.end(), batch, batch + n);
+        } else if (q.try_pop(batch[0])) {
+            got.push_back(batch[0]);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    ASSERT_TRUE(q.empty());
+    for (int i = 0; i < count; ++i) ASSERT_EQ(i, got[i]);
+}
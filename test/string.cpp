@@ -111,3 +111,49 @@ TEST(string, insert_iterator_init_list)
 	ASSERT_EQ(str, comp);
 	(void)str;
 }
+
+TEST(string, growth_policy)
+{
+	basic_string<char, std::allocator<char>, exact_growth> str(
+		"This is a long string used to test heap allocation");
+	ASSERT_EQ(51, str.capacity());
+	str.push_back('!');
+	ASSERT_EQ(52, str.capacity());
+	ASSERT_EQ('!', str.back());
+}
+
+TEST(string, resize_and_overwrite)
+{
+	string str;
+	str.resize_and_overwrite(5, [](char* p, size_t n) {
+		for (size_t i = 0; i < n; ++i) p[i] = 'a';
+		return n - 1;
+	});
+	ASSERT_EQ(4, str.size());
+	ASSERT_STREQ("aaaa", str.c_str());
+
+	str.resize_and_overwrite(100, [](char* p, size_t n) {
+		for (size_t i = 4; i < n; ++i) p[i] = 'b';
+		return n;
+	});
+	ASSERT_EQ(100, str.size());
+	ASSERT_EQ('a', str[3]);
+	ASSERT_EQ('b', str[4]);
+	ASSERT_EQ(0, str.c_str()[100]);
+}
+
+TEST(string, copy_assign)
+{
+	string a("small");
+	string b("a string long enough for the heap");
+	string c;
+	c = a;
+	ASSERT_EQ(a, c);
+	c = b;
+	ASSERT_EQ(b, c);
+	c = a;
+	ASSERT_EQ(a, c);
+	a.swap(b);
+	ASSERT_EQ(c, b);
+	ASSERT_EQ(string("a string long enough for the heap"), a);
+}
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include <ftl/thread_cached_allocator>
+#include <ftl/vector>
+#include <ftl/string>
+#include <thread>
+#include <cstdint>
+
+using namespace ftl;
+
+TEST(thread_cached_allocator, size_classes)
+{
+    using heap = thread_cache_heap;
+    ASSERT_EQ(0, heap::class_of(1, 1));
+    ASSERT_EQ(0, heap::class_of(16, 8));
+    ASSERT_EQ(1, heap::class_of(17, 8));
+    ASSERT_EQ(2, heap::class_of(8, 64));
+    ASSERT_EQ(heap::class_count, heap::class_of(heap::max_class_size + 1, 8));
+    ASSERT_EQ(8, heap::class_of(4096, 4096));
+    ASSERT_EQ(heap::class_count, heap::class_of(8192, 8192));
+    ASSERT_EQ(64, heap::batch_size(0));
+    ASSERT_EQ(2, heap::batch_size(heap::class_count - 1));
+}
+
+TEST(thread_cached_allocator, reuses_blocks)
+{
+    thread_cached_allocator<int> alloc;
+    int* p = alloc.allocate(10);
+    p[9] = 1;
+    alloc.deallocate(p, 10);
+    ASSERT_EQ(p, alloc.allocate(12));
+    alloc.deallocate(p, 12);
+
+    thread_cached_allocator<double> other(alloc);
+    ASSERT_TRUE(other == alloc);
+}
+
+TEST(thread_cached_allocator, over_aligned)
+{
+    struct alignas(8192) page_pair {
+        unsigned char bytes[8192];
+    };
+
+    thread_cached_allocator<page_pair> alloc;
+    page_pair* p[4];
+    for (auto& x : p) {
+        x = alloc.allocate(1);
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(x) % 8192);
+    }
+    for (auto& x : p) alloc.deallocate(x, 1);
+}
+
+TEST(thread_cached_allocator, large_blocks)
+{
+    thread_cached_allocator<char> alloc;
+    const std::size_t n = thread_cache_heap::max_class_size * 4;
+    char* p = alloc.allocate(n);
+    p[0] = 1;
+    p[n - 1] = 1;
+    alloc.deallocate(p, n);
+}
+
+TEST(thread_cached_allocator, returns_batches_to_depot)
+{
+    using heap = thread_cache_heap;
+    thread_cached_allocator<char> alloc;
+    const std::size_t batch = heap::batch_size(0);
+    vector<char*> blocks;
+    for (std::size_t i = 0; i < 4 * batch; ++i) blocks.push_back(alloc.allocate(8));
+    for (char* p : blocks) alloc.deallocate(p, 8);
+    ASSERT_LT(heap::cached_blocks(0), 2 * batch);
+}
+
+TEST(thread_cached_allocator, containers_across_threads)
+{
+    using string_type =
+        basic_string<char, thread_cached_allocator<char>>;
+    using vector_type =
+        vector<string_type, thread_cached_allocator<string_type>>;
+
+    vector_type shared;
+    for (int i = 0; i < 1000; ++i)
+        shared.push_back(string_type(64, 'a'));
+
+    vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.push_back(std::thread([&shared, t] {
+            for (int round = 0; round < 50; ++round) {
+                vector_type v;
+                for (int i = 0; i < 100; ++i)
+                    v.push_back(string_type(32 + i, char('a' + t)));
+                if (v[99].size() != 131) std::abort();
+            }
+            // free blocks allocated by another thread
+            if (t == 0) shared = vector_type();
+        }));
+    }
+    for (auto& th : threads) th.join();
+    ASSERT_TRUE(shared.empty());
+}
+
+TEST(thread_cached_allocator, container_outlives_thread_cache)
+{
+    using vector_type = vector<int, thread_cached_allocator<int>>;
+    std::thread th([] {
+        // constructed before, hence destroyed after, the thread's cache
+        thread_local vector_type v;
+        for (int i = 0; i < 1000; ++i) v.push_back(i);
+    });
+    th.join();
+
+    vector_type w(1000, 1);
+    ASSERT_EQ(w[999], 1);
+}
@@ -0,0 +1,183 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include <ftl/unrolled_list>
+
+using namespace ftl;
+
+namespace {
+    template <typename L>
+    std::vector<typename L::value_type> to_vector(const L& l)
+    {
+        std::vector<typename L::value_type> v;
+        for (const auto& x : l) v.push_back(x);
+        return v;
+    }
+}
+
+TEST(unrolled_list, construct_default)
+{
+    unrolled_list<int> x;
+    ASSERT_TRUE(x.empty());
+    ASSERT_EQ(0u, x.block_count());
+    ASSERT_EQ(x.begin(), x.end());
+}
+
+TEST(unrolled_list, push_back_fills_blocks)
+{
+    unrolled_list<int, 4> x;
+    for (int i = 0; i < 10; ++i) x.push_back(i);
+    ASSERT_EQ(10u, x.size());
+    ASSERT_EQ(3u, x.block_count());
+    ASSERT_EQ(0, x.front());
+    ASSERT_EQ(9, x.back());
+
+    int expected = 0;
+    for (auto v : x) ASSERT_EQ(expected++, v);
+
+    expected = 9;
+    for (auto it = x.rbegin(); it != x.rend(); ++it) ASSERT_EQ(expected--, *it);
+}
+
+TEST(unrolled_list, push_front)
+{
+    unrolled_list<int, 4> x;
+    for (int i = 0; i < 10; ++i) x.push_front(i);
+    ASSERT_EQ((std::vector<int> { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }),
+        to_vector(x));
+}
+
+TEST(unrolled_list, insert_middle_splits)
+{
+    unrolled_list<int, 4> x { 0, 1, 2, 3 };
+    ASSERT_EQ(1u, x.block_count());
+    auto it = x.insert(x.begin() + 1, 10);
+    ASSERT_EQ(10, *it);
+    ASSERT_EQ(2u, x.block_count());
+    ASSERT_EQ((std::vector<int> { 0, 10, 1, 2, 3 }), to_vector(x));
+
+    it = x.insert(x.begin() + 4, 20);
+    ASSERT_EQ(20, *it);
+    ASSERT_EQ(3, *++it);
+    ASSERT_EQ((std::vector<int> { 0, 10, 1, 2, 20, 3 }), to_vector(x));
+}
+
+TEST(unrolled_list, matches_reference_model)
+{
+    unrolled_list<std::string, 5> x;
+    std::vector<std::string> ref;
+    unsigned seed = 7;
+    for (int step = 0; step < 2000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        const size_t pos = ref.empty() ? 0 : (seed >> 8) % (ref.size() + 1);
+        if ((seed >> 4) % 3 != 0 || ref.empty()) {
+            auto s = std::to_string(step);
+            x.insert(x.begin() + pos, s);
+            ref.insert(ref.begin() + pos, s);
+        } else {
+            const size_t e = pos == ref.size() ? pos - 1 : pos;
+            auto it = x.erase(x.begin() + e);
+            ref.erase(ref.begin() + e);
+            if (e < ref.size()) {
+                ASSERT_EQ(ref[e], *it);
+            } else {
+                ASSERT_EQ(x.end(), it);
+            }
+        }
+        ASSERT_EQ(ref.size(), x.size());
+    }
+    ASSERT_EQ(ref, to_vector(x));
+}
+
+TEST(unrolled_list, erase_frees_and_merges_blocks)
+{
+    unrolled_list<int, 8> x;
+    for (int i = 0; i < 16; ++i) x.push_back(i);
+    ASSERT_EQ(2u, x.block_count());
+
+    x.erase(x.begin() + 8, x.begin() + 12);
+    ASSERT_EQ(2u, x.block_count());
+
+    // leaves one element in the first block, which absorbs the second
+    auto it = x.erase(x.begin() + 1, x.begin() + 8);
+    ASSERT_EQ(12, *it);
+    ASSERT_EQ(1u, x.block_count());
+    ASSERT_EQ((std::vector<int> { 0, 12, 13, 14, 15 }), to_vector(x));
+
+    while (!x.empty()) x.pop_back();
+    ASSERT_EQ(0u, x.block_count());
+}
+
+TEST(unrolled_list, splice)
+{
+    unrolled_list<int, 4> x { 1, 2, 3, 4, 5, 6 };
+    unrolled_list<int, 4> y { 10, 11, 12 };
+    x.splice(x.begin() + 4, y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ(9u, x.size());
+    ASSERT_EQ((std::vector<int> { 1, 2, 3, 4, 10, 11, 12, 5, 6 }),
+        to_vector(x));
+
+    // splitting the block of pos
+    x.splice(x.begin() + 1, unrolled_list<int, 4> { 20 });
+    ASSERT_EQ((std::vector<int> { 1, 20, 2, 3, 4, 10, 11, 12, 5, 6 }),
+        to_vector(x));
+    x.splice(x.end(), unrolled_list<int, 4> { 30 });
+    ASSERT_EQ(30, x.back());
+    y.push_back(1);
+    ASSERT_EQ(1u, y.size());
+}
+
+TEST(unrolled_list, copy_and_move)
+{
+    unrolled_list<std::string, 2> x { "a", "b", "c" };
+    auto y = x;
+    ASSERT_EQ(x, y);
+    auto z = std::move(y);
+    ASSERT_TRUE(y.empty());
+    ASSERT_EQ(x, z);
+    z.push_back("d");
+    ASSERT_NE(x, z);
+    y = z;
+    ASSERT_EQ(4u, y.size());
+    swap(x, y);
+    ASSERT_EQ("d", x.back());
+    ASSERT_EQ("c", y.back());
+}
+
+TEST(unrolled_list, insert_aliased_element)
+{
+    unrolled_list<std::string, 4> l { "a", "b", "c", "d" };
+    l.insert(l.begin(), l.back());
+    ASSERT_EQ("d", l.front());
+    l.insert(l.end(), l.front());
+    ASSERT_EQ((std::vector<std::string>{ "d", "a", "b", "c", "d", "d" }),
+        to_vector(l));
+}
+
+namespace {
+    struct thrower {
+        int value;
+
+        explicit thrower(int v) : value(v)
+        {
+            if (v < 0) throw v;
+        }
+    };
+}
+
+TEST(unrolled_list, throwing_emplace_frees_block)
+{
+    unrolled_list<thrower, 2> l;
+    ASSERT_THROW(l.emplace_back(-1), int);
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(0u, l.block_count());
+    ASSERT_EQ(l.begin(), l.end());
+
+    l.emplace_back(1);
+    l.emplace_back(2);
+    ASSERT_THROW(l.emplace_back(-1), int);
+    ASSERT_EQ(1u, l.block_count());
+    ASSERT_EQ(2u, l.size());
+    ASSERT_EQ(2, l.back().value);
+}
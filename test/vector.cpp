@@ -176,3 +176,406 @@ TEST(vector, reverse_iterator_traversal)
     (void)v;
     (void)u;
 }
+
+namespace {
+    struct tracked {
+        static int copies;
+        static int moves;
+        static int live;
+
+        tracked(int v = 0) : value(v) { ++live; }
+        tracked(const tracked& o) : value(o.value) { ++copies; ++live; }
+        tracked(tracked&& o) noexcept : value(o.value) { ++moves; ++live; }
+        ~tracked() { --live; }
+
+        int value;
+    };
+
+    int tracked::copies = 0;
+    int tracked::moves = 0;
+    int tracked::live = 0;
+}
+
+TEST(vector, relocation_traits)
+{
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(is_trivially_relocatable_v<vector<std::string>>);
+    static_assert(!is_trivially_relocatable_v<tracked>);
+}
+
+TEST(vector, reserve_moves_elements)
+{
+    tracked::copies = tracked::moves = tracked::live = 0;
+    {
+        vector<tracked> x;
+        for (int i = 0; i < 100; ++i) x.emplace_back(i);
+        x.reserve(1000);
+        x.shrink_to_fit();
+        ASSERT_EQ(0, tracked::copies);
+        ASSERT_EQ(100, tracked::live);
+        for (int i = 0; i < 100; ++i) ASSERT_EQ(i, x[i].value);
+    }
+    ASSERT_EQ(0, tracked::live);
+}
+
+TEST(vector, move_only_growth)
+{
+    vector<std::unique_ptr<int>> x;
+    for (int i = 0; i < 33; ++i) x.push_back(std::make_unique<int>(i));
+    ASSERT_EQ(33, x.size());
+    for (int i = 0; i < 33; ++i) ASSERT_EQ(i, *x[i]);
+}
+
+TEST(vector, nested_growth)
+{
+    vector<vector<int>> x;
+    for (int i = 0; i < 20; ++i) x.emplace_back(static_cast<size_t>(i), i);
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_EQ(static_cast<size_t>(i), x[i].size());
+        if (i) {
+            ASSERT_EQ(i, x[i].back());
+        }
+    }
+}
+
+TEST(vector, push_back_self_reference)
+{
+    vector<std::string> x{ "a long string that does not fit in SSO" };
+    for (int i = 0; i < 10; ++i) x.push_back(x[0]);
+    ASSERT_EQ(11, x.size());
+    ASSERT_EQ(x[0], x[10]);
+}
+
+TEST(vector, push_back_fills_capacity)
+{
+    vector<int> x;
+    x.reserve(4);
+    for (int i = 0; i < 4; ++i) x.push_back(i);
+    ASSERT_EQ(4, x.capacity());
+    x.push_back(4);
+    ASSERT_EQ(8, x.capacity());
+}
+
+TEST(vector, growth_policies)
+{
+    vector<int, std::allocator<int>, one_and_half_growth> half;
+    half.reserve(10);
+    for (int i = 0; i < 11; ++i) half.push_back(i);
+    ASSERT_EQ(15, half.capacity());
+
+    vector<int, std::allocator<int>, exact_growth> exact;
+    for (int i = 0; i < 5; ++i) exact.push_back(i);
+    ASSERT_EQ(5, exact.capacity());
+
+    vector<char, std::allocator<char>, page_growth<>> page;
+    page.resize(5000);
+    ASSERT_EQ(0, page.capacity() % 4096);
+    ASSERT_LE(5000, page.capacity());
+    ASSERT_EQ(4, (page_growth<>::next(0, 3, 1)));
+}
+
+TEST(vector, iterator_distance)
+{
+    vector<int> x{ 1, 2, 3, 4, 5 };
+    ASSERT_EQ(5, x.end() - x.begin());
+    vector<int> y(x.begin(), x.end());
+    ASSERT_EQ(x, y);
+}
+
+TEST(vector, insert_single)
+{
+    vector<int> x{ 1, 3 };
+    auto it = x.insert(x.begin() + 1, 2);
+    ASSERT_EQ(2, *it);
+    x.insert(x.end(), 4);
+    x.insert(x.begin(), 0);
+    ASSERT_EQ((vector<int>{ 0, 1, 2, 3, 4 }), x);
+}
+
+TEST(vector, insert_count)
+{
+    vector<int> x{ 1, 2, 3 };
+    x.reserve(16);
+    x.insert(x.begin() + 1, 3, x[0]);
+    ASSERT_EQ((vector<int>{ 1, 1, 1, 1, 2, 3 }), x);
+    x.insert(x.begin(), 20, 7);
+    ASSERT_EQ(26, x.size());
+    ASSERT_EQ(7, x[19]);
+    ASSERT_EQ(1, x[20]);
+}
+
+TEST(vector, insert_range)
+{
+    vector<std::string> x{ "a", "d" };
+    vector<std::string> y{ "b", "c" };
+    x.insert(x.begin() + 1, y.begin(), y.end());
+    ASSERT_EQ((vector<std::string>{ "a", "b", "c", "d" }), x);
+    x.reserve(32);
+    x.insert(x.begin() + 2, { "x", "y" });
+    ASSERT_EQ((vector<std::string>{ "a", "b", "x", "y", "c", "d" }), x);
+}
+
+TEST(vector, append_range)
+{
+    vector<int> x{ 1 };
+    int arr[] = { 2, 3, 4 };
+    x.append_range(arr);
+    x.append_range(vector<int>{ 5, 6 });
+    ASSERT_EQ((vector<int>{ 1, 2, 3, 4, 5, 6 }), x);
+}
+
+TEST(vector, erase)
+{
+    vector<int> x{ 1, 2, 3, 4, 5, 6 };
+    auto it = x.erase(x.begin() + 1, x.begin() + 3);
+    ASSERT_EQ(4, *it);
+    ASSERT_EQ((vector<int>{ 1, 4, 5, 6 }), x);
+    x.erase(x.begin());
+    ASSERT_EQ((vector<int>{ 4, 5, 6 }), x);
+
+    vector<std::string> s{ "a", "b", "c" };
+    s.erase(s.begin() + 1);
+    ASSERT_EQ((vector<std::string>{ "a", "c" }), s);
+}
+
+TEST(vector, erase_if)
+{
+    vector<int> x{ 1, 2, 3, 4, 5, 6, 7 };
+    ASSERT_EQ(3, erase_if(x, [](int v) { return v % 2 == 0; }));
+    ASSERT_EQ((vector<int>{ 1, 3, 5, 7 }), x);
+    ASSERT_EQ(1, erase(x, 5));
+    ASSERT_EQ((vector<int>{ 1, 3, 7 }), x);
+}
+
+TEST(vector, assign)
+{
+    vector<int> x{ 1, 2, 3 };
+    x.assign(2, 9);
+    ASSERT_EQ((vector<int>{ 9, 9 }), x);
+    x.assign(10, 1);
+    ASSERT_EQ(10, x.size());
+    x.assign({ 4, 5 });
+    ASSERT_EQ((vector<int>{ 4, 5 }), x);
+}
+
+TEST(vector, resize_uninitialized)
+{
+    vector<int> x{ 1, 2 };
+    x.resize_uninitialized(100);
+    ASSERT_EQ(100, x.size());
+    ASSERT_LE(100, x.capacity());
+    ASSERT_EQ(2, x[1]);
+    for (int i = 0; i < 100; ++i) x[i] = i;
+    x.resize_uninitialized(10);
+    ASSERT_EQ(10, x.size());
+    ASSERT_EQ(9, x.back());
+
+    vector<std::string> s{ "a" };
+    s.resize_default_init(3);
+    ASSERT_EQ(3, s.size());
+    ASSERT_TRUE(s[2].empty());
+}
+
+TEST(vector, operator_equality_empty)
+{
+    vector<int> x;
+    vector<int> y;
+    ASSERT_EQ(x, y);
+    y.push_back(1);
+    ASSERT_NE(x, y);
+}
+
+TEST(vector, compare)
+{
+    vector<unsigned> x(100, 7u);
+    vector<unsigned> y(100, 7u);
+    ASSERT_EQ(0, x.compare(y));
+    y[67] = 0x100;
+    ASSERT_LT(x.compare(y), 0);
+    ASSERT_GT(y.compare(x), 0);
+    ASSERT_TRUE(x < y);
+    ASSERT_TRUE(y >= x);
+    x[67] = 0x101;
+    ASSERT_TRUE(x > y);
+
+    vector<unsigned> prefix(50, 7u);
+    ASSERT_TRUE(prefix < y);
+
+    vector<std::string> a{ "a", "b" };
+    vector<std::string> b{ "a", "c" };
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(a <= a);
+    ASSERT_FALSE(a == b);
+}
+
+TEST(vector, compare_doubles)
+{
+    vector<double> x{ 0.0, 1.0 };
+    vector<double> y{ -0.0, 1.0 };
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(0, x.compare(y));
+}
+
+namespace {
+    // equal when the values agree modulo 10, whatever the bytes
+    struct mod10 {
+        int value;
+    };
+
+    bool operator==(mod10 l, mod10 r) { return l.value % 10 == r.value % 10; }
+    bool operator<(mod10 l, mod10 r) { return l.value % 10 < r.value % 10; }
+
+    struct key {
+        unsigned value;
+    };
+
+    bool operator==(key l, key r) { return l.value == r.value; }
+    bool operator<(key l, key r) { return l.value < r.value; }
+}
+
+template <>
+struct ftl::is_bitwise_comparable<key> : std::true_type {};
+
+TEST(vector, mismatch_bytes)
+{
+    unsigned char l[100], r[100];
+    for (std::size_t n = 0; n <= sizeof(l); ++n) {
+        for (std::size_t i = 0; i < n; ++i)
+            l[i] = r[i] = static_cast<unsigned char>(i);
+        ASSERT_EQ(n, mismatch_bytes(l, r, n));
+        for (std::size_t i = 0; i < n; ++i) {
+            r[i] ^= 0x80;
+            ASSERT_EQ(i, mismatch_bytes(l, r, n));
+            r[i] ^= 0x80;
+        }
+    }
+}
+
+TEST(vector, compare_user_operators)
+{
+    static_assert(!is_bitwise_comparable_v<mod10>);
+    vector<mod10> x{ { 1 }, { 12 } };
+    vector<mod10> y{ { 11 }, { 2 } };
+    ASSERT_EQ(x, y);
+    ASSERT_EQ(0, x.compare(y));
+
+    y[1].value = 9;
+    x[1].value = 20;
+    ASSERT_TRUE(x < y);
+
+    static_assert(is_bitwise_comparable_v<key>);
+    vector<key> a{ { 1 }, { 0x100 } };
+    vector<key> b{ { 1 }, { 0x101 } };
+    ASSERT_TRUE(a < b);
+    ASSERT_NE(a, b);
+    ASSERT_TRUE(a[0] == b[0]);
+}
+
+TEST(vector_bool, construct_and_access)
+{
+    vector<bool> x(130, true);
+    ASSERT_EQ(130, x.size());
+    ASSERT_EQ(3, x.word_count());
+    ASSERT_EQ(130, x.count());
+    ASSERT_TRUE(x.all());
+
+    x[64] = false;
+    x.at(129) = false;
+    ASSERT_FALSE(x[64]);
+    ASSERT_FALSE(x.back());
+    ASSERT_EQ(128, x.count());
+    ASSERT_THROW(x.at(130), array_out_of_range);
+
+    x[0].flip();
+    ASSERT_FALSE(x.front());
+    x[1] = x[0];
+    ASSERT_FALSE(x[1]);
+
+    vector<bool> y{ true, false, true };
+    ASSERT_EQ(3, y.size());
+    ASSERT_EQ(5u, y.data()[0]);
+}
+
+TEST(vector_bool, push_pop_resize)
+{
+    vector<bool> x;
+    for (int i = 0; i < 200; ++i) x.push_back(i % 3 == 0);
+    ASSERT_EQ(200, x.size());
+    ASSERT_GE(x.capacity(), 200);
+    ASSERT_EQ(67, x.count());
+
+    while (x.size() > 65) x.pop_back();
+    ASSERT_EQ(22, x.count());
+    // bits popped from the last word must not come back
+    x.resize(128);
+    ASSERT_EQ(22, x.count());
+    x.resize(300, true);
+    ASSERT_EQ(22 + 172, x.count());
+    x.resize(10);
+    ASSERT_EQ(4, x.count());
+    x.flip();
+    ASSERT_EQ(6, x.count());
+    x.shrink_to_fit();
+    ASSERT_EQ(64, x.capacity());
+}
+
+TEST(vector_bool, find_and_iterate)
+{
+    vector<bool> x(1000);
+    ASSERT_EQ(1000, x.find_first());
+    ASSERT_TRUE(x.none());
+
+    const size_t set[] = { 3, 63, 64, 500, 999 };
+    for (size_t i : set) x[i] = true;
+    ASSERT_TRUE(x.any());
+
+    size_t n = 0;
+    for (size_t i = x.find_first(); i != x.size(); i = x.find_next(i))
+        ASSERT_EQ(set[n++], i);
+    ASSERT_EQ(5, n);
+
+    n = 0;
+    x.for_each_set([&](size_t i) { ASSERT_EQ(set[n++], i); });
+    ASSERT_EQ(5, n);
+
+    ASSERT_EQ(5, std::count(x.begin(), x.end(), true));
+    ASSERT_EQ(1000, x.end() - x.begin());
+    for (auto it = x.begin(); it != x.end(); ++it) *it = !*it;
+    ASSERT_EQ(995, x.count());
+}
+
+TEST(vector_bool, bitwise_operators)
+{
+    vector<bool> a(100);
+    vector<bool> b(100);
+    for (size_t i = 0; i < 100; i += 2) a[i] = true;
+    for (size_t i = 0; i < 100; i += 3) b[i] = true;
+
+    ASSERT_EQ(17, (a & b).count());
+    ASSERT_EQ(50 + 34 - 17, (a | b).count());
+    ASSERT_EQ(50 + 34 - 34, (a ^ b).count());
+
+    vector<bool> c(a);
+    c ^= a;
+    ASSERT_TRUE(c.none());
+
+    vector<bool> d(99);
+    ASSERT_THROW(a &= d, vector_size_mismatch);
+    ASSERT_THROW(a | d, vector_size_mismatch);
+}
+
+TEST(vector_bool, compare)
+{
+    vector<bool> a(100);
+    vector<bool> b(100);
+    ASSERT_EQ(a, b);
+    b[70] = true;
+    ASSERT_NE(a, b);
+    ASSERT_LT(a.compare(b), 0);
+    ASSERT_TRUE(a < b);
+    a[69] = true;
+    ASSERT_TRUE(a > b);
+
+    vector<bool> prefix(50);
+    ASSERT_TRUE(prefix < a);
+}